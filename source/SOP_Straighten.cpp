@@ -27,12 +27,18 @@ INCLUDES                                                           |
 
 // SESI
 #include <UT/UT_Interrupt.h>
+#include <UT/UT_ParallelUtil.h>
+#include <UT/UT_WorkBuffer.h>
 #include <OP/OP_AutoLockInputs.h>
 #include <CH/CH_Manager.h>
 #include <PRM/PRM_Parm.h>
 #include <PRM/PRM_Error.h>
 #include <PRM/PRM_Include.h>
 #include <GU/GU_EdgeUtils.h>
+#include <GU/GU_DetailHandle.h>
+#include <GU/GU_PrimPacked.h>
+#include <GU/GU_PackedGeometry.h>
+#include <GA/GA_Iterator.h>
 
 #if _WIN32		
 	#include <sys/SYS_Math.h>
@@ -64,6 +70,9 @@ DEFINES                                                            |
 // very important
 #define SOP_GroupFieldIndex_0	1
 
+// relaxation sweep weight, anything in (0, 1) makes all shapes decay monotonically
+#define RELAX_DAMPING			0.5f
+
 #define UI						GET_SOP_Namespace()::UI
 #define PRM_ACCESS				GET_Base_Namespace()::Utility::PRM
 #define GRP_ACCESS				GET_Base_Namespace()::Utility::Groups
@@ -81,8 +90,14 @@ PARAMETERLIST_Start(SOP_Operator)
 	UI::improperEdgeIslandErrorModeChoiceMenu_Parameter,
 
 	UI::mainSectionSwitcher_Parameter,	
+	UI::packedGeometryToggle_Parameter,
+	UI::packedGeometrySeparator_Parameter,
 	UI::uniformDistributionToggle_Parameter,
 	UI::uniformDistributionSeparator_Parameter,	
+	UI::setRelaxToggle_Parameter,
+	UI::relaxIterationsInteger_Parameter,
+	UI::relaxToleranceFloat_Parameter,
+	UI::setRelaxSeparator_Parameter,
 
 	UI::additionalSectionSwitcher_Parameter,
 	UI::setMorphToggle_Parameter,
@@ -107,6 +122,11 @@ SOP_Operator::updateParmsFlags()
 
 	/* ---------------------------- Set States --------------------------------------- */
 	
+	PRM_ACCESS::Get::IntPRM(this, visibilityState, UI::setRelaxToggle_Parameter, currentTime);
+	changed |= setVisibleState(UI::relaxIterationsInteger_Parameter.getToken(), visibilityState);
+	changed |= setVisibleState(UI::relaxToleranceFloat_Parameter.getToken(), visibilityState);
+	changed |= enableParm(UI::uniformDistributionToggle_Parameter.getToken(), !visibilityState);
+
 	PRM_ACCESS::Get::IntPRM(this, visibilityState, UI::setMorphToggle_Parameter, currentTime);
 	changed |= setVisibleState(UI::morphPowerFloat_Parameter.getToken(), visibilityState);
 
@@ -158,85 +178,142 @@ SOP_Operator::CallbackSetMorph(void* data, int index, float time, const PRM_Temp
 	return 1;
 }
 
-OP_ERROR 
-SOP_Operator::StraightenEachEdgeIsland(GA_EdgeIslandBundle& edgeislands, UT_AutoInterrupt progress, fpreal time)
-{	
-	UT_Map<GA_Offset, UT_Vector3>	originalPositions;
-	UT_Map<GA_Offset, UT_Vector3>	edits;
+static bool
+RelaxEdgeIsland(GU_Detail& detail, const GA_OffsetArray& points, exint iterations, fpreal tolerance, UT_AutoInterrupt& progress)
+{
+	const auto entries = points.entries();
+	if (entries < 3) return true;
 
-	bool							setMorphState;
-	fpreal							morphPowerState;
-	bool							setUniformDistributionState;
-	exint							edgeIslandErrorLevelState;
+	// positions are kept as separate flat component arrays, so each sweep runs over contiguous memory and vectorizes across points
+	UT_Array<fpreal32>	current[3];
+	UT_Array<fpreal32>	next[3];
 
-	PRM_ACCESS::Get::IntPRM(this, setUniformDistributionState, UI::uniformDistributionToggle_Parameter, time);
+	for (auto component = 0; component < 3; component++) current[component].setSizeNoInit(entries);
+	for (exint i = 0; i < entries; i++)
+	{
+		const auto position = detail.getPos3(points(i));
+		for (auto component = 0; component < 3; component++) current[component](i) = position(component);
+	}
 
-	PRM_ACCESS::Get::IntPRM(this, setMorphState, UI::setMorphToggle_Parameter, time);
-	PRM_ACCESS::Get::FloatPRM(this, morphPowerState, UI::morphPowerFloat_Parameter, time);	
-	morphPowerState = setMorphState ? 0.01 * morphPowerState : 1.0; // convert from percentage
-	
-	PRM_ACCESS::Get::IntPRM(this, edgeIslandErrorLevelState, UI::improperEdgeIslandErrorModeChoiceMenu_Parameter, time);
+	// endpoints are never written by sweep, so they have to be present in both buffers
+	for (auto component = 0; component < 3; component++) next[component] = current[component];
 
-#define PROGRESS_ESCAPE(node, message, passedprogress) if (passedprogress.wasInterrupted()) { node->addError(SOP_ErrorCodes::SOP_MESSAGE, message); return error(); }	
-	for (auto island : edgeislands)
+	// line between endpoints, island is straight enough once its largest distance from it relative to its length drops below tolerance
+	const auto first = UT_Vector3(current[0](0), current[1](0), current[2](0));
+	auto direction = UT_Vector3(current[0](entries - 1), current[1](entries - 1), current[2](entries - 1)) - first;
+	const auto length = direction.normalize();
+
+	const auto earlyExit = tolerance > 0.0 && length > 0.0f;
+	const auto toleranceSquared = static_cast<fpreal32>(tolerance * tolerance * length * length);
+
+	for (exint iteration = 0; iteration < iterations; iteration++)
 	{
-		PROGRESS_ESCAPE(this, "Operation interrupted", progress)
-					
-#ifdef DEBUG_ISLANDS
-		island.Report();
-#endif // DEBUG_ISLANDS		
-		
-		// ignore not correct ones
-		if (!island.IsValid())
+		if (progress.wasInterrupted()) return false;
+
+		// damped Jacobi sweep, each inner point moves halfway toward the middle of its neighbours from previous sweep,
+		// without damping the highest frequency shapes (zigzags) only flip sign every sweep instead of decaying
+		for (auto component = 0; component < 3; component++)
 		{
-			switch (edgeIslandErrorLevelState)
-			{
-				default: /* do nothing */ continue;
-				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Warning) : { addWarning(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } continue;
-				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Error) : { addError(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } return error();				
-			}
+			const fpreal32* SYS_RESTRICT src = current[component].array();
+			fpreal32* SYS_RESTRICT dst = next[component].array();
+
+			for (exint i = 1; i < entries - 1; i++) dst[i] = src[i] + RELAX_DAMPING * (0.5f * (src[i - 1] + src[i + 1]) - src[i]);
 		}
 
-		// ignore single edge ones
-		if (island.GetEdges().size() <= 1) continue;
-		
-		// store original positions		
-		auto it = island.Begin();
-		for (it; !it.atEnd(); it.advance())
+		for (auto component = 0; component < 3; component++) current[component].swap(next[component]);
+		if (!earlyExit) continue;
+
+		fpreal32 maxDistanceSquared = 0.0f;
+		for (exint i = 1; i < entries - 1; i++)
 		{
-			PROGRESS_ESCAPE(this, "Operation interrupted", progress)
-			originalPositions[*it] = this->gdp->getPos3(*it);
+			const auto x = current[0](i) - first.x();
+			const auto y = current[1](i) - first.y();
+			const auto z = current[2](i) - first.z();
+			const auto along = x * direction.x() + y * direction.y() + z * direction.z();
+			maxDistanceSquared = SYSmax(maxDistanceSquared, x * x + y * y + z * z - along * along);
 		}
 
+		if (maxDistanceSquared < toleranceSquared) break;
+	}
+
+	for (exint i = 1; i < entries - 1; i++) detail.setPos3(points(i), UT_Vector3(current[0](i), current[1](i), current[2](i)));
+
+	return true;
+}
+
+void
+SOP_Operator::GetStraightenStates(StraightenStates& states, fpreal time)
+{
+	PRM_ACCESS::Get::IntPRM(this, states.setUniformDistributionState, UI::uniformDistributionToggle_Parameter, time);
+
+	PRM_ACCESS::Get::IntPRM(this, states.setRelaxState, UI::setRelaxToggle_Parameter, time);
+	PRM_ACCESS::Get::IntPRM(this, states.relaxIterationsState, UI::relaxIterationsInteger_Parameter, time);
+	PRM_ACCESS::Get::FloatPRM(this, states.relaxToleranceState, UI::relaxToleranceFloat_Parameter, time);
+
+	PRM_ACCESS::Get::IntPRM(this, states.setMorphState, UI::setMorphToggle_Parameter, time);
+	PRM_ACCESS::Get::FloatPRM(this, states.morphPowerState, UI::morphPowerFloat_Parameter, time);	
+	states.morphPowerState = states.setMorphState ? 0.01 * states.morphPowerState : 1.0; // convert from percentage
+	
+	PRM_ACCESS::Get::IntPRM(this, states.edgeIslandErrorLevelState, UI::improperEdgeIslandErrorModeChoiceMenu_Parameter, time);
+}
+
+template <typename EdgeIsland>
+static bool
+StraightenEdgeIsland(GU_Detail& detail, EdgeIsland& island, const GET_SOP_Namespace()::StraightenStates& states, UT_AutoInterrupt& progress)
+{
+	UT_Map<GA_Offset, UT_Vector3>	originalPositions;
+	UT_Map<GA_Offset, UT_Vector3>	edits;
+	GA_OffsetArray					islandPoints;
+
+	// store original positions		
+	auto it = island.Begin();
+	for (it; !it.atEnd(); it.advance())
+	{
+		if (progress.wasInterrupted()) return false;
+		originalPositions[*it] = detail.getPos3(*it);
+	}
+
+	// relax toward line, or straighten at once
+	if (states.setRelaxState)
+	{
+		islandPoints.clear();
+
+		it = island.Begin();
+		for (it; !it.atEnd(); it.advance()) islandPoints.append(*it);
+
+		if (!RelaxEdgeIsland(detail, islandPoints, states.relaxIterationsState, states.relaxToleranceState, progress)) return false;
+	}
+	else
+	{
 		// calculate direction
-		auto direction = this->gdp->getPos3(island.Last()) - this->gdp->getPos3(island.First());
+		auto direction = detail.getPos3(island.Last()) - detail.getPos3(island.First());
 		direction.normalize();
-		
+	
 		// straighten edges
 		edits.clear();
 
-		GUstraightenEdges(edits, *gdp, island.GetEdges(), &direction);
+		GUstraightenEdges(edits, detail, island.GetEdges(), &direction);
 		for (const auto edit : edits)
 		{
-			PROGRESS_ESCAPE(this, "Operation interrupted", progress)			 
-			this->gdp->setPos3(edit.first, edit.second);
+			if (progress.wasInterrupted()) return false;
+			detail.setPos3(edit.first, edit.second);
 		}		
 
 		// uniform distribution
-		if (setUniformDistributionState)
+		if (states.setUniformDistributionState)
 		{		
 			// if anyone wonders why I didn't used GUevenlySpaceEdges to do this, my algorithm works better, SESI version fails in some situations			
 			/*
 			edits.clear();		
-		
-			GUevenlySpaceEdges(edits, *gdp, island.GetEdges());
+	
+			GUevenlySpaceEdges(edits, detail, island.GetEdges());
 			for (auto edit : edits)
 			{
-				PROGRESS_ESCAPE(this, "Operation interrupted", progress)			
-				this->gdp->setPos3(edit.first, edit.second);
+				if (progress.wasInterrupted()) return false;
+				detail.setPos3(edit.first, edit.second);
 			}*/
 
-			const auto distance = (this->gdp->getPos3(island.Last()) - this->gdp->getPos3(island.First())).length() / (island.Entries() - 1);
+			const auto distance = (detail.getPos3(island.Last()) - detail.getPos3(island.First())).length() / (island.Entries() - 1);
 
 			UT_Vector3 currentPosition;					
 			exint multiplier = 0;
@@ -246,7 +323,7 @@ SOP_Operator::StraightenEachEdgeIsland(GA_EdgeIslandBundle& edgeislands, UT_Auto
 			{
 				if (multiplier == 0)
 				{
-					currentPosition = this->gdp->getPos3(*it);
+					currentPosition = detail.getPos3(*it);
 					multiplier++;
 				}
 
@@ -254,25 +331,236 @@ SOP_Operator::StraightenEachEdgeIsland(GA_EdgeIslandBundle& edgeislands, UT_Auto
 				if (*it == island.First() || *it == island.Last()) continue;
 
 				const auto newPosition = currentPosition + (direction * (distance * multiplier));
-				this->gdp->setPos3(*it, newPosition);
+				detail.setPos3(*it, newPosition);
 
 				multiplier++;
 			}
 		}
+	}
 
-		// morph
-		if (!setMorphState) continue;
+	// morph
+	if (!states.setMorphState) return true;
 
-		it = island.Begin();
-		for (it; !it.atEnd(); it.advance())
+	it = island.Begin();
+	for (it; !it.atEnd(); it.advance())
+	{
+		if (progress.wasInterrupted()) return false;
+		const auto newPos = SYSlerp(originalPositions[*it], detail.getPos3(*it), states.morphPowerState);
+		detail.setPos3(*it, newPos);
+	}
+
+	return true;
+}
+
+OP_ERROR 
+SOP_Operator::StraightenEachEdgeIsland(GU_Detail& detail, GA_EdgeIslandBundle& edgeislands, const StraightenStates& states, UT_AutoInterrupt& progress)
+{	
+	for (auto island : edgeislands)
+	{
+		if (progress.wasInterrupted()) break;
+					
+#ifdef DEBUG_ISLANDS
+		island.Report();
+#endif // DEBUG_ISLANDS		
+		
+		// ignore not correct ones
+		if (!island.IsValid())
 		{
-			PROGRESS_ESCAPE(this, "Operation interrupted", progress)
-			const auto newPos = SYSlerp(originalPositions[*it], this->gdp->getPos3(*it), morphPowerState);
-			this->gdp->setPos3(*it, newPos);
+			switch (states.edgeIslandErrorLevelState)
+			{
+				default: /* do nothing */ continue;
+				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Warning) : { addWarning(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } continue;
+				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Error) : { addError(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } return error();				
+			}
 		}
+
+		// ignore single edge ones
+		if (island.GetEdges().size() <= 1) continue;
+		if (!StraightenEdgeIsland(detail, island, states, progress)) break;
 	}
-#undef PROGRESS_ESCAPE
 
+	if (progress.wasInterrupted()) addError(SOP_ErrorCodes::SOP_MESSAGE, "Operation interrupted");
+	return error();
+}
+
+OP_ERROR
+SOP_Operator::ReportGroupNotSpecified(fpreal time)
+{
+	clearSelection();
+
+	exint groupNotSpecifiedState;
+	PRM_ACCESS::Get::IntPRM(this, groupNotSpecifiedState, UI::groupNotSpecifiedErrorModeChoiceMenu_Parameter, time);
+	switch (groupNotSpecifiedState)
+	{
+		default: /* do nothing */ break;
+		case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Warning) : { addWarning(SOP_ErrorCodes::SOP_ERR_BADGROUP); } break;
+		case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Error) : { addError(SOP_ErrorCodes::SOP_ERR_BADGROUP); } break;
+	}
+
+	return error();
+}
+
+OP_ERROR
+SOP_Operator::StraightenEachPackedPrimitive(const UT_String& edgegroupname, const StraightenStates& states, UT_AutoInterrupt& progress, fpreal time)
+{
+	struct PackedPiece
+	{
+		UT_Array<GA_Offset>		primitiveOffsets;
+		GU_ConstDetailHandle	source;
+		GU_DetailHandle			result;
+		GA_EdgeIslandBundle		edgeIslands;
+		GA_Size					size;
+	};
+
+	UT_Array<PackedPiece>		pieces;
+	UT_Map<exint, exint>		pieceIndices;
+	UT_Map<exint, bool>			visitedDetails;
+	exint						skippedCount = 0;
+	exint						improperCount = 0;
+	auto						groupFound = false;
+
+	// instanced pieces share single embedded detail, so they are keyed by it and straightened only once,
+	// edge islands are found on read-only source, so only pieces that will actually change get copied
+	for (GA_Iterator primIt(this->gdp->getPrimitiveRange()); !primIt.atEnd(); primIt.advance())
+	{
+		if (progress.wasInterrupted()) break;
+
+		const auto primitive = this->gdp->getPrimitive(*primIt);
+		if (primitive->getTypeId() != GU_PackedGeometry::typeId()) continue;
+
+		const auto packedPrimitive = UTverify_cast<const GU_PrimPacked*>(primitive);
+		const auto source = packedPrimitive->implementation()->getPackedDetail();
+
+		GU_DetailHandleAutoReadLock sourceLock(source);
+		const auto sourceDetail = sourceLock.getGdp();
+		if (!sourceDetail) continue;
+
+		const auto detailId = sourceDetail->getUniqueId();
+		const auto found = pieceIndices.find(detailId);
+		if (found != pieceIndices.end())
+		{
+			pieces(found->second).primitiveOffsets.append(*primIt);
+			continue;
+		}
+
+		if (visitedDetails.find(detailId) != visitedDetails.end()) continue;
+		visitedDetails[detailId] = true;
+
+		const auto edgeGroup = sourceDetail->findEdgeGroup(edgegroupname.buffer());
+		if (!edgeGroup || edgeGroup->isEmpty()) continue;
+		groupFound = true;
+
+		auto edgeData = GA_EdgesData();
+		edgeData.Clear();
+
+		auto edgeIslands = GA_EdgeIslandBundle();
+		edgeIslands.clear();
+
+		if (!GRP_ACCESS::Edge::Break::PerPoint(this, edgeGroup, edgeData, progress) || !GRP_ACCESS::Edge::Break::PerIsland(this, edgeData, edgeIslands, EdgeIslandType::OPEN, progress))
+		{
+			skippedCount++;
+			continue;
+		}
+
+		auto straightenable = false;
+		for (auto& island : edgeIslands)
+		{
+			if (!island.IsValid()) improperCount++;
+			else if (island.GetEdges().size() > 1) straightenable = true;
+		}
+
+		// nothing to straighten, so piece stays shared with input
+		if (!straightenable) continue;
+
+		pieceIndices[detailId] = pieces.entries();
+		pieces.append(PackedPiece{ UT_Array<GA_Offset>(), source, GU_DetailHandle(), edgeIslands, sourceDetail->getNumPoints() });
+		pieces.last().primitiveOffsets.append(*primIt);
+	}
+
+	if (progress.wasInterrupted())
+	{
+		addError(SOP_ErrorCodes::SOP_MESSAGE, "Operation interrupted");
+		return error();
+	}
+
+	if (skippedCount > 0)
+	{
+		UT_WorkBuffer message;
+		message.sprintf("%" SYS_PRId64 " packed geometry pieces skipped, could not split their edge group on edge islands.", skippedCount);
+		addWarning(SOP_ErrorCodes::SOP_MESSAGE, message.buffer());
+	}
+
+	if (improperCount > 0)
+	{
+		switch (states.edgeIslandErrorLevelState)
+		{
+			default: /* do nothing */ break;
+			case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Warning) : { addWarning(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } break;
+			case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Error) : { addError(SOP_ErrorCodes::SOP_MESSAGE, "Edge islands with more than 2 endpoints detected."); } return error();
+		}
+	}
+
+	if (error() >= OP_ERROR::UT_ERROR_ABORT) return error();
+	if (!groupFound) return ReportGroupNotSpecified(time);
+
+	// with zero power morph would bring every point back, so there is nothing to modify
+	if (states.morphPowerState <= 0.0) return error();
+
+	// biggest pieces go first, indices are handed out in order, so smaller ones fill remaining cores while they finish
+	pieces.stdsort([](const PackedPiece& a, const PackedPiece& b) { return a.size > b.size; });
+
+	// workers never touch the node, result stays empty when piece was interrupted
+	UTparallelForEachNumber(pieces.entries(), [&](const UT_BlockedRange<exint>& range)
+	{
+		for (auto i = range.begin(); i != range.end(); ++i)
+		{
+			if (progress.wasInterrupted()) return;
+
+			auto& piece = pieces(i);
+
+			// duplicate keeps element offsets, so islands found on source are valid for the copy
+			auto detail = new GU_Detail();
+			{
+				GU_DetailHandleAutoReadLock sourceLock(piece.source);
+				detail->duplicate(*sourceLock.getGdp());
+			}
+
+			GU_DetailHandle handle;
+			handle.allocateAndSet(detail);
+
+			auto interrupted = false;
+			for (auto& island : piece.edgeIslands)
+			{
+				if (!island.IsValid() || island.GetEdges().size() <= 1) continue;
+
+				interrupted = !StraightenEdgeIsland(*detail, island, states, progress);
+				if (interrupted) break;
+			}
+
+			if (!interrupted) piece.result = handle;
+		}
+	});
+
+	if (progress.wasInterrupted())
+	{
+		addError(SOP_ErrorCodes::SOP_MESSAGE, "Operation interrupted");
+		return error();
+	}
+
+	// swap embedded geometry of modified pieces only, all instances point to the same result
+	for (const auto& piece : pieces)
+	{
+		if (!piece.result.isValid()) continue;
+
+		for (const auto primitiveOffset : piece.primitiveOffsets)
+		{
+			auto packedPrimitive = UTverify_cast<GU_PrimPacked*>(this->gdp->getPrimitive(primitiveOffset));
+			auto implementation = UTverify_cast<GU_PackedGeometry*>(packedPrimitive->hardenImplementation());
+			implementation->setDetailPtr(piece.result);
+		}
+	}
+
+	if (pieces.entries() > 0) this->gdp->getPrimitiveList().bumpDataId();
 	return error();
 }
 
@@ -285,25 +573,29 @@ SOP_Operator::cookMySop(OP_Context &context)
 {
 	DEFAULTS_CookMySop()
 		
-	if (duplicatePointSource(0, context) < OP_ERROR::UT_ERROR_WARNING && error() < OP_ERROR::UT_ERROR_WARNING && cookInputGroups(context) < OP_ERROR::UT_ERROR_WARNING)
-	{						
-		// group cooking could pass, but we need to be sure that we have any groups specified at all
-		auto success = this->_edgeGroupInput0 && !this->_edgeGroupInput0->isEmpty();
-		if ((success && error() >= OP_ERROR::UT_ERROR_WARNING) || (!success && error() >= OP_ERROR::UT_ERROR_NONE))
+	if (duplicatePointSource(0, context) < OP_ERROR::UT_ERROR_WARNING && error() < OP_ERROR::UT_ERROR_WARNING)
+	{
+		bool packedGeometryState;
+		PRM_ACCESS::Get::IntPRM(this, packedGeometryState, UI::packedGeometryToggle_Parameter, currentTime);
+
+		StraightenStates states;
+		GetStraightenStates(states, currentTime);
+
+		// edge group lives inside of each packed primitive, so all we need here is its name
+		if (packedGeometryState)
 		{
-			clearSelection();
+			UT_String edgeGroupName;
+			evalString(edgeGroupName, UI::input0EdgeGroup_Parameter.getToken(), 0, currentTime);
 
-			exint groupNotSpecifiedState;
-			PRM_ACCESS::Get::IntPRM(this, groupNotSpecifiedState, UI::groupNotSpecifiedErrorModeChoiceMenu_Parameter, currentTime);
-			switch (groupNotSpecifiedState)
-			{
-				default: /* do nothing */ break;
-				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Warning) : { addWarning(SOP_ErrorCodes::SOP_ERR_BADGROUP); } break;
-				case static_cast<exint>(HOU_NODE_ERROR_LEVEL::Error) : { addError(SOP_ErrorCodes::SOP_ERR_BADGROUP); } break;
-			}
-			
-			return error();
-		}		
+			if (!edgeGroupName.isstring()) return ReportGroupNotSpecified(currentTime);
+			return StraightenEachPackedPrimitive(edgeGroupName, states, progress, currentTime);
+		}
+
+		if (cookInputGroups(context) >= OP_ERROR::UT_ERROR_WARNING) return error();
+
+		// group cooking could pass, but we need to be sure that we have any groups specified at all
+		auto success = this->_edgeGroupInput0 && !this->_edgeGroupInput0->isEmpty();
+		if ((success && error() >= OP_ERROR::UT_ERROR_WARNING) || (!success && error() >= OP_ERROR::UT_ERROR_NONE)) return ReportGroupNotSpecified(currentTime);
 
 		// edge selection can contain multiple separate edge island, so before we find them, we need to find their endpoints, so we could have some starting point		
 		auto edgeData = GA_EdgesData();
@@ -320,7 +612,7 @@ SOP_Operator::cookMySop(OP_Context &context)
 		if ((success && error() >= OP_ERROR::UT_ERROR_WARNING) || (!success && error() >= OP_ERROR::UT_ERROR_NONE)) return error();
 
 		// finally, we can go thru each edge island and calculate and apply straighten
-		return StraightenEachEdgeIsland(edgeIslands, progress, currentTime);
+		return StraightenEachEdgeIsland(*this->gdp, edgeIslands, states, progress);
 	}
 
 	return error();
@@ -352,6 +644,7 @@ UNDEFINES                                                          |
 #undef UI
 
 #undef SOP_GroupFieldIndex_0
+#undef RELAX_DAMPING
 
 #undef MSS_Selector
 #undef SOP_Base_Operator
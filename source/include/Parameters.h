@@ -37,6 +37,7 @@ INCLUDES                                                           |
 #include <Macros/TogglePRM.h>
 #include <Macros/SeparatorPRM.h>
 #include <Macros/ErrorLevelMenuPRM.h>
+#include <Macros/IntegerPRM.h>
 
 // this
 #include "SOP_Straighten.h"
@@ -61,8 +62,12 @@ DECLARE_SOP_Namespace_Start()
 		DECLARE_ErroLevelMenu_PRM("groupnotspecifiederrormode", "Group Not Specified", 1, 0, "Specify group not specified node error mode.", groupNotSpecified)
 		DECLARE_ErroLevelMenu_PRM("improperedgeislanderrormode", "Improper Edge Island", 1, 0, "Specify improper edge island detection node error mode.", improperEdgeIsland)
 
-		__DECLARE_Main_Section_PRM(2)		
+		__DECLARE_Main_Section_PRM(8)		
+		DECLARE_Toggle_with_Separator_OFF_PRM("setpackedgeometry", "Packed Geometry", "setpackedgeometryseparator", 0, "Straighten edge group of the same name inside each packed geometry primitive, instead of input geometry itself.", packedGeometry)
 		DECLARE_Toggle_with_Separator_OFF_PRM("setuniformpointdistribution", "Uniform Point Distribution", "setuniformpointdistributionseparator", 0, "Uniformly distribute points to create even length edges.", uniformDistribution)		
+		DECLARE_Toggle_with_Separator_OFF_PRM("setrelax", "Relax", "setrelaxseparator", 0, "Iteratively pull points toward the line between endpoints, instead of projecting them on it.", setRelax)
+		DECLARE_Custom_Int_MinR_to_MaxU_PRM("relaxiterations", "Iterations", 1, 100, 10, 0, "Specify number of relaxation sweeps.", relaxIterations)
+		DECLARE_Custom_Float_MinR_to_MaxU_PRM("relaxtolerance", "Tolerance", 0, 1, 0, 0, "Stop relaxing edge island once its largest distance from line between endpoints, relative to endpoints distance, is below this value. Zero disables early exit.", relaxTolerance)
 
 		__DECLARE_Additional_Section_PRM(7)		
 		DECLARE_Toggle_with_Separator_OFF_PRM("setmorph", "Morph", "setmorphseparator", &SOP_Operator::CallbackSetMorph, "Blend between original and modified position.", setMorph)
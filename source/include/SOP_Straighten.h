@@ -55,6 +55,7 @@ FORWARDS                                                           |
 ----------------------------------------------------------------- */
 
 class UT_AutoInterrupt;
+class UT_String;
 
 /* -----------------------------------------------------------------
 OPERATOR DECLARATION                                               |
@@ -62,6 +63,18 @@ OPERATOR DECLARATION                                               |
 
 DECLARE_SOP_Namespace_Start()
 
+	// parameter values evaluated once per cook, so straighten itself never needs to touch the node
+	struct StraightenStates
+	{
+		bool								setUniformDistributionState;
+		bool								setRelaxState;
+		exint								relaxIterationsState;
+		fpreal								relaxToleranceState;
+		bool								setMorphState;
+		fpreal								morphPowerState;
+		exint								edgeIslandErrorLevelState;
+	};
+
 	class SOP_Straighten : public SOP_Node
 	{
 		DECLARE_CookMySop()
@@ -85,7 +98,10 @@ DECLARE_SOP_Namespace_Start()
 		static int							CallbackSetMorph(void* data, int index, float time, const PRM_Template* tmp);
 
 	private:
-		OP_ERROR							StraightenEachEdgeIsland(GA_EdgeIslandBundle& edgeislands, UT_AutoInterrupt progress, fpreal time);
+		void								GetStraightenStates(StraightenStates& states, fpreal time);
+		OP_ERROR							StraightenEachEdgeIsland(GU_Detail& detail, GA_EdgeIslandBundle& edgeislands, const StraightenStates& states, UT_AutoInterrupt& progress);
+		OP_ERROR							StraightenEachPackedPrimitive(const UT_String& edgegroupname, const StraightenStates& states, UT_AutoInterrupt& progress, fpreal time);
+		OP_ERROR							ReportGroupNotSpecified(fpreal time);
 
 		const GA_EdgeGroup*					_edgeGroupInput0;		
 	};